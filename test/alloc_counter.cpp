@@ -0,0 +1,27 @@
+#include "alloc_counter.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+thread_local AllocStats *current = nullptr;
+
+} // namespace
+
+AllocCounter::AllocCounter() : prev(current) { current = &stats; }
+
+AllocCounter::~AllocCounter() { current = prev; }
+
+void *operator new(std::size_t size) {
+    if (current) {
+        current->allocations++;
+        current->bytes += size;
+    }
+    if (void *p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+// Out of line on purpose: once inlined, GCC's -Wmismatched-new-delete flags free() on memory that
+// it saw come from operator new, which breaks optimized -Werror builds
+[[gnu::noinline]] void operator delete(void *p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void *p, std::size_t) noexcept { std::free(p); }
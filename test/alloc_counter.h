@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+
+// Heap allocations made on the calling thread while an AllocCounter is alive. The counting comes
+// from the replaced global operator new in alloc_counter.cpp, so only binaries that link that file
+// see non-zero counts. test.cpp keeps its own copy because it must build on its own.
+
+struct AllocStats {
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+};
+
+class AllocCounter {
+public:
+    AllocCounter();
+    ~AllocCounter();
+
+    AllocCounter(const AllocCounter &) = delete;
+    AllocCounter &operator=(const AllocCounter &) = delete;
+
+    const AllocStats &Stats() const { return stats; }
+
+private:
+    AllocStats stats;
+    AllocStats *prev;
+};
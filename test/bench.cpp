@@ -0,0 +1,206 @@
+#include "GatorBST.h"
+#include "alloc_counter.h"
+#include "latency_histogram.h"
+#include "perf_counters.h"
+#include "zipf_generator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Benchmark driver for GatorBST. Prints one CSV row per (operation, distribution, size):
+//   op,dist,n,ops,total_ns,ns_per_op,ops_per_sec,p50_ns,p99_ns,p999_ns,max_ns,
+//   unit,cycles,l1d_misses,llc_misses,dtlb_misses,branch_misses,allocs_per_op,bytes_per_op
+// Throughput columns come from an untimed loop; percentiles from a second pass timing each call.
+// Heap allocations (alloc_counter.cpp is linked into this binary only) are counted during that
+// second pass, per call.
+// Hardware counters cover the untimed loop and are divided by the number of units: operations
+// for Insert/SearchID/Remove, nodes visited for the O(n) scans. Unavailable counters print empty.
+// Usage: BenchGatorBST [max_n] [max_degenerate_n]
+// zipfian inserts in the same shuffled order as random, so its Insert row is the same workload
+// measured again; the distributions differ in their SearchID probes.
+// Sorted and reverse-sorted inputs build a linked list in a plain BST (O(n^2) inserts, n-deep
+// recursion), so they are capped separately.
+
+namespace {
+
+enum class Dist { Random, Sorted, Reverse, Zipfian };
+
+const char *DistName(Dist d) {
+    switch (d) {
+        case Dist::Random: return "random";
+        case Dist::Sorted: return "sorted";
+        case Dist::Reverse: return "reverse";
+        case Dist::Zipfian: return "zipfian";
+    }
+    return "?";
+}
+
+// Keeps the optimizer from discarding results of the timed calls.
+volatile size_t sink;
+
+// Counts events over each Time() window; Report() prints the most recent window.
+PerfCounters counters;
+
+void Report(const char *op, Dist dist, size_t n, size_t ops, chrono::nanoseconds elapsed,
+            const LatencyHistogram &latency, const AllocStats &allocs, const char *unit,
+            size_t units) {
+    double ns = double(elapsed.count());
+    double nsPerOp = ops ? ns / double(ops) : 0.0;
+    double opsPerSec = ns > 0 ? double(ops) * 1e9 / ns : 0.0;
+    printf("%s,%s,%zu,%zu,%.0f,%.2f,%.0f,%llu,%llu,%llu,%llu,%s", op, DistName(dist), n, ops, ns,
+           nsPerOp, opsPerSec, (unsigned long long)latency.Percentile(0.50),
+           (unsigned long long)latency.Percentile(0.99), (unsigned long long)latency.Percentile(0.999),
+           (unsigned long long)latency.Max(), unit);
+    for (int e = 0; e < PerfCounters::kEvents; e++) {
+        optional<uint64_t> count = counters.Value(PerfEvent(e));
+        if (count && units) printf(",%.3f", double(*count) / double(units));
+        else printf(",");
+    }
+    double calls = double(max<uint64_t>(latency.Count(), 1));
+    printf(",%.2f,%.1f\n", double(allocs.allocations) / calls, double(allocs.bytes) / calls);
+    fflush(stdout);
+}
+
+template <typename F>
+chrono::nanoseconds Time(F &&f) {
+    counters.Start();
+    auto start = chrono::steady_clock::now();
+    f();
+    auto elapsed = chrono::steady_clock::now() - start;
+    counters.Stop();
+    return chrono::duration_cast<chrono::nanoseconds>(elapsed);
+}
+
+// Times each call op(i), i in [0, count), into a freshly reset histogram, and counts the heap
+// allocations the calls make.
+template <typename F>
+void Sample(LatencyHistogram &latency, AllocStats &allocs, size_t count, F &&op) {
+    latency.Reset();
+    size_t acc = 0;
+    AllocCounter counter;
+    for (size_t i = 0; i < count; i++) {
+        auto start = chrono::steady_clock::now();
+        acc += size_t(op(i));
+        auto elapsed = chrono::steady_clock::now() - start;
+        latency.Record(uint64_t(chrono::duration_cast<chrono::nanoseconds>(elapsed).count()));
+    }
+    allocs = counter.Stats();
+    sink = acc;
+}
+
+void Run(Dist dist, size_t n, mt19937_64 &rng) {
+    // Distinct UFIDs spread over the 8-digit range, in the insertion order for this distribution.
+    vector<int> keys(n);
+    for (size_t i = 0; i < n; i++) keys[i] = 10000000 + int(i) * 7;
+    if (dist == Dist::Random || dist == Dist::Zipfian) shuffle(keys.begin(), keys.end(), rng);
+    if (dist == Dist::Reverse) reverse(keys.begin(), keys.end());
+
+    // A small pool of names so SearchName has many matches per query.
+    const size_t namePool = 1000;
+    vector<string> names(namePool);
+    for (size_t i = 0; i < namePool; i++) names[i] = "Student" + to_string(i);
+
+    // SearchID order: the insertion order, or Zipf-skewed ranks over it for zipfian.
+    vector<int> probes = keys;
+    if (dist == Dist::Zipfian) {
+        ZipfGenerator zipf(n, 0.99);
+        for (int &p : probes) p = keys[zipf(rng)];
+    }
+    // Removal order: every key once, in a random order, for every distribution. Removing in
+    // insertion order would delete a sorted chain's root each time, in O(1).
+    vector<int> removals = keys;
+    shuffle(removals.begin(), removals.end(), rng);
+
+    // O(n) operations get enough calls to be measurable without dominating the run.
+    const size_t scans = clamp<size_t>(1000000 / n, 1, 100);
+
+    // Per-call latencies for the mutating operations come from a separate tree, built and emptied
+    // up front so only one full tree is alive at a time.
+    LatencyHistogram insertLatency, removeLatency, latency;
+    AllocStats insertAllocs, removeAllocs, allocs;
+    {
+        GatorBST sampled;
+        Sample(insertLatency, insertAllocs, n,
+               [&](size_t i) { return sampled.Insert(keys[i], names[i % namePool]); });
+        Sample(removeLatency, removeAllocs, n,
+               [&](size_t i) { return sampled.Remove(removals[i]); });
+    }
+
+    GatorBST tree;
+    Report("Insert", dist, n, n, Time([&] {
+        size_t ok = 0;
+        for (size_t i = 0; i < n; i++) ok += tree.Insert(keys[i], names[i % namePool]);
+        sink = ok;
+    }), insertLatency, insertAllocs, "op", n);
+    // Scans are normalized by nodes visited; the dummy implementation keeps none.
+    const size_t nodes = tree.TraverseInorder().size();
+    Sample(latency, allocs, n, [&](size_t i) { return tree.SearchID(probes[i]).has_value(); });
+    Report("SearchID", dist, n, n, Time([&] {
+        size_t found = 0;
+        for (int p : probes) found += tree.SearchID(p).has_value();
+        sink = found;
+    }), latency, allocs, "op", n);
+    Sample(latency, allocs, scans,
+           [&](size_t i) { return tree.SearchName(names[i % namePool]).size(); });
+    Report("SearchName", dist, n, scans, Time([&] {
+        size_t found = 0;
+        for (size_t i = 0; i < scans; i++) found += tree.SearchName(names[i % namePool]).size();
+        sink = found;
+    }), latency, allocs, "node", scans * nodes);
+    Sample(latency, allocs, scans, [&](size_t) { return tree.Height(); });
+    Report("Height", dist, n, scans, Time([&] {
+        size_t h = 0;
+        for (size_t i = 0; i < scans; i++) h += size_t(tree.Height());
+        sink = h;
+    }), latency, allocs, "node", scans * nodes);
+    Sample(latency, allocs, scans, [&](size_t) { return tree.TraversePreorder().size(); });
+    Report("TraversePreorder", dist, n, scans, Time([&] {
+        size_t visited = 0;
+        for (size_t i = 0; i < scans; i++) visited += tree.TraversePreorder().size();
+        sink = visited;
+    }), latency, allocs, "node", scans * nodes);
+    Sample(latency, allocs, scans, [&](size_t) { return tree.TraverseInorder().size(); });
+    Report("TraverseInorder", dist, n, scans, Time([&] {
+        size_t visited = 0;
+        for (size_t i = 0; i < scans; i++) visited += tree.TraverseInorder().size();
+        sink = visited;
+    }), latency, allocs, "node", scans * nodes);
+    Sample(latency, allocs, scans, [&](size_t) { return tree.TraversePostorder().size(); });
+    Report("TraversePostorder", dist, n, scans, Time([&] {
+        size_t visited = 0;
+        for (size_t i = 0; i < scans; i++) visited += tree.TraversePostorder().size();
+        sink = visited;
+    }), latency, allocs, "node", scans * nodes);
+    Report("Remove", dist, n, n, Time([&] {
+        size_t removed = 0;
+        for (int k : removals) removed += tree.Remove(k);
+        sink = removed;
+    }), removeLatency, removeAllocs, "op", n);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    size_t maxN = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t maxDegenerateN = argc > 2 ? strtoull(argv[2], nullptr, 10) : 10000;
+
+    mt19937_64 rng(0x6a7042535421ULL);
+    printf("op,dist,n,ops,total_ns,ns_per_op,ops_per_sec,p50_ns,p99_ns,p999_ns,max_ns,unit");
+    for (int e = 0; e < PerfCounters::kEvents; e++) printf(",%s", PerfCounters::Name(PerfEvent(e)));
+    printf(",allocs_per_op,bytes_per_op\n");
+    for (Dist dist : {Dist::Random, Dist::Sorted, Dist::Reverse, Dist::Zipfian}) {
+        bool degenerate = dist == Dist::Sorted || dist == Dist::Reverse;
+        for (size_t n = 1000; n <= maxN; n *= 10) {
+            if (degenerate && n > maxDegenerateN) break;
+            Run(dist, n, rng);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// HDR-style latency histogram: values below 2^kSubBits ns are exact, and every power-of-two range
+// above is split into 2^kSubBits linear sub-buckets, so any percentile is within ~3% of the truth.
+class LatencyHistogram {
+public:
+    void Record(uint64_t ns) {
+        counts[BucketOf(ns)]++;
+        total++;
+        maxNs = std::max(maxNs, ns);
+    }
+
+    // Folds another histogram in, e.g. per-thread histograms into one report.
+    void Merge(const LatencyHistogram &other) {
+        for (std::size_t b = 0; b < counts.size(); b++) counts[b] += other.counts[b];
+        total += other.total;
+        maxNs = std::max(maxNs, other.maxNs);
+    }
+
+    void Reset() {
+        counts.fill(0);
+        total = 0;
+        maxNs = 0;
+    }
+
+    // Upper bound of the bucket holding the p-quantile (0 < p <= 1), capped at the observed max.
+    uint64_t Percentile(double p) const {
+        if (total == 0) return 0;
+        uint64_t rank = std::max<uint64_t>(1, uint64_t(std::ceil(p * double(total))));
+        uint64_t seen = 0;
+        for (std::size_t b = 0; b < counts.size(); b++) {
+            seen += counts[b];
+            if (seen >= rank) return std::min(UpperBound(b), maxNs);
+        }
+        return maxNs;
+    }
+
+    uint64_t Count() const { return total; }
+    uint64_t Max() const { return maxNs; }
+
+private:
+    static constexpr int kSubBits = 5;
+    static constexpr uint64_t kSubCount = uint64_t(1) << kSubBits;
+
+    static std::size_t BucketOf(uint64_t v) {
+        if (v < kSubCount) return std::size_t(v);
+        int shift = (63 - std::countl_zero(v)) - kSubBits;
+        return (std::size_t(shift + 1) << kSubBits) + std::size_t((v >> shift) & (kSubCount - 1));
+    }
+
+    static uint64_t UpperBound(std::size_t b) {
+        if (b < kSubCount) return b;
+        int shift = int(b >> kSubBits) - 1;
+        return ((kSubCount + (b & (kSubCount - 1)) + 1) << shift) - 1;
+    }
+
+    std::array<uint64_t, (64 - kSubBits + 1) << kSubBits> counts{};
+    uint64_t total = 0;
+    uint64_t maxNs = 0;
+};
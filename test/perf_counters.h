@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Per-thread hardware event counters for the benchmark drivers, via perf_event_open(2). Each event
+// is opened on its own rather than as a group, so an event the CPU or kernel refuses (no PMU in a
+// VM, perf_event_paranoid too high, non-Linux builds) reads as nullopt without disabling the rest.
+// Counts are scaled by time_enabled / time_running when the kernel multiplexes them.
+
+enum class PerfEvent { Cycles, L1DMisses, LLCMisses, DTLBMisses, BranchMisses, Count };
+
+class PerfCounters {
+public:
+    static constexpr int kEvents = int(PerfEvent::Count);
+
+    static const char *Name(PerfEvent e) {
+        static const char *const names[] = {"cycles", "l1d_misses", "llc_misses", "dtlb_misses",
+                                            "branch_misses"};
+        return names[int(e)];
+    }
+
+    PerfCounters() {
+#ifdef __linux__
+        std::fill(std::begin(fds), std::end(fds), -1);
+        const uint64_t readMiss = (uint64_t(PERF_COUNT_HW_CACHE_OP_READ) << 8) |
+                                  (uint64_t(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+        fds[int(PerfEvent::Cycles)] = Open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        fds[int(PerfEvent::L1DMisses)] =
+            Open(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | readMiss);
+        fds[int(PerfEvent::LLCMisses)] =
+            Open(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | readMiss);
+        fds[int(PerfEvent::DTLBMisses)] =
+            Open(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | readMiss);
+        fds[int(PerfEvent::BranchMisses)] = Open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+    }
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (int fd : fds)
+            if (fd >= 0) close(fd);
+#endif
+    }
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    void Start() {
+#ifdef __linux__
+        for (int fd : fds) {
+            if (fd < 0) continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void Stop() {
+#ifdef __linux__
+        for (int fd : fds)
+            if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        for (int e = 0; e < kEvents; e++) {
+            values[e].reset();
+            uint64_t buf[3];  // value, time_enabled, time_running
+            if (fds[e] < 0 || read(fds[e], buf, sizeof(buf)) != ssize_t(sizeof(buf))) continue;
+            if (buf[2] == 0) continue;
+            values[e] = buf[2] < buf[1] ? uint64_t(double(buf[0]) * double(buf[1]) / double(buf[2]))
+                                        : buf[0];
+        }
+#endif
+    }
+
+    // Count from the last Start()/Stop() window, or nullopt if the event is unavailable.
+    std::optional<uint64_t> Value(PerfEvent e) const { return values[int(e)]; }
+
+private:
+#ifdef __linux__
+    static int Open(uint32_t type, uint64_t config) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    int fds[kEvents];  // -1 for events that could not be opened
+#endif
+    std::optional<uint64_t> values[kEvents];
+};
@@ -0,0 +1,115 @@
+#include "GatorBST.h"
+#include "latency_histogram.h"
+#include "trace.h"
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Replays a trace written by RecordedGatorBST against a fresh GatorBST, as fast as possible, and
+// prints one CSV row per operation type plus a total row:
+//   op,ops,total_ns,ns_per_op,ops_per_sec,p50_ns,p99_ns,p999_ns,max_ns
+// The trace is replayed twice, each time on a fresh tree, like BenchGatorBST: once as one untimed
+// loop for the throughput columns, once timing each call for the percentiles. Per-call clock reads
+// would dominate cheap calls such as SearchID, so throughput is only reported for the whole trace
+// (the All row); per-operation rows leave those columns empty.
+// Usage: ReplayGatorBST <trace file>
+
+namespace {
+
+volatile size_t sink;
+
+size_t Apply(GatorBST &tree, const TraceRecord &r, const string &name) {
+    switch (r.op) {
+        case TraceOp::Insert: return tree.Insert(r.ufid, name);
+        case TraceOp::Remove: return tree.Remove(r.ufid);
+        case TraceOp::SearchID: return tree.SearchID(r.ufid).has_value();
+        case TraceOp::SearchName: return tree.SearchName(name).size();
+        case TraceOp::Height: return size_t(tree.Height());
+        case TraceOp::TraversePreorder: return tree.TraversePreorder().size();
+        case TraceOp::TraverseInorder: return tree.TraverseInorder().size();
+        case TraceOp::TraversePostorder: return tree.TraversePostorder().size();
+        case TraceOp::Count: break;
+    }
+    return 0;
+}
+
+// totalNs is nullopt for rows without an untimed measurement.
+void Report(const char *op, optional<uint64_t> totalNs, const LatencyHistogram &latency) {
+    uint64_t ops = latency.Count();
+    printf("%s,%llu,", op, (unsigned long long)ops);
+    if (totalNs) {
+        double nsPerOp = ops ? double(*totalNs) / double(ops) : 0.0;
+        double opsPerSec = *totalNs ? double(ops) * 1e9 / double(*totalNs) : 0.0;
+        printf("%llu,%.2f,%.0f", (unsigned long long)*totalNs, nsPerOp, opsPerSec);
+    } else {
+        printf(",,");
+    }
+    printf(",%llu,%llu,%llu,%llu\n", (unsigned long long)latency.Percentile(0.50),
+           (unsigned long long)latency.Percentile(0.99), (unsigned long long)latency.Percentile(0.999),
+           (unsigned long long)latency.Max());
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <trace file>\n", argv[0]);
+        return 2;
+    }
+
+    vector<TraceRecord> records;
+    try {
+        records = ReadTrace(argv[1]);
+    } catch (const exception &e) {
+        fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    // Names are rebuilt before the clock starts so string construction is not charged to the tree.
+    vector<string> names(records.size());
+    for (size_t i = 0; i < records.size(); i++)
+        if (records[i].nameLength)
+            names[i] = TraceSyntheticName(records[i].nameHash, records[i].nameLength);
+
+    // Throughput pass: the whole trace under one pair of clock reads.
+    uint64_t overallNs;
+    {
+        GatorBST tree;
+        size_t acc = 0;
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < records.size(); i++) acc += Apply(tree, records[i], names[i]);
+        overallNs = uint64_t(
+            chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+        sink = acc;
+    }
+
+    // Latency pass: every call timed on its own.
+    const size_t opCount = size_t(TraceOp::Count);
+    vector<LatencyHistogram> latency(opCount);
+    LatencyHistogram overall;
+    {
+        GatorBST tree;
+        size_t acc = 0;
+        for (size_t i = 0; i < records.size(); i++) {
+            auto start = chrono::steady_clock::now();
+            acc += Apply(tree, records[i], names[i]);
+            uint64_t ns = uint64_t(chrono::duration_cast<chrono::nanoseconds>(
+                                       chrono::steady_clock::now() - start)
+                                       .count());
+            latency[size_t(records[i].op)].Record(ns);
+            overall.Record(ns);
+        }
+        sink = acc;
+    }
+
+    printf("op,ops,total_ns,ns_per_op,ops_per_sec,p50_ns,p99_ns,p999_ns,max_ns\n");
+    for (size_t op = 0; op < opCount; op++)
+        if (latency[op].Count()) Report(TraceOpName(TraceOp(op)), nullopt, latency[op]);
+    Report("All", overallNs, overall);
+    return 0;
+}
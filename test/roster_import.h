@@ -0,0 +1,205 @@
+#pragma once
+
+#include "GatorBST.h"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GATORBST_ROSTER_MMAP 1
+#endif
+
+// Bulk roster import for GatorBST from a CSV or TSV export with one "UFID<delim>name" record per
+// line. The delimiter is the first ',' or '\t' on each line, so both formats load. A name wrapped
+// in double quotes may contain the delimiter, with "" for a literal quote. A trailing '\r' is
+// dropped. The file is memory-mapped where the platform allows it, and lines are found with
+// memchr, which the C library vectorizes.
+// Records go into the tree through batched Insert calls. Insert takes const std::string&, so each
+// name is copied out of the mapping once into a reused batch slot; it cannot stay a view.
+
+enum class RosterIssue { Malformed, Duplicate };
+
+inline const char *RosterIssueName(RosterIssue issue) {
+    return issue == RosterIssue::Malformed ? "malformed" : "duplicate";
+}
+
+struct RosterImportStats {
+    std::size_t lines = 0;      // non-empty lines after the skipped header lines
+    std::size_t inserted = 0;
+    std::size_t duplicates = 0; // Insert returned false: the UFID was already in the tree
+    std::size_t malformed = 0;  // no delimiter, bad UFID, or an unterminated quoted name
+};
+
+// Called once per bad line with its 1-based line number and raw text; the import carries on.
+// Duplicates are found when their batch is inserted, so they can arrive after later malformed lines.
+using RosterIssueHandler =
+    std::function<void(RosterIssue issue, std::size_t line, std::string_view text)>;
+
+namespace roster_detail {
+
+// Read-only view of a whole file: a private mapping where available, a heap copy otherwise.
+class FileView {
+public:
+    explicit FileView(const std::string &path) {
+#ifdef GATORBST_ROSTER_MMAP
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) Throw(path);
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            int err = errno;
+            close(fd);
+            errno = err;
+            Throw(path);
+        }
+        size = std::size_t(st.st_size);
+        if (size) {
+            void *p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                int err = errno;
+                close(fd);
+                errno = err;
+                Throw(path);
+            }
+            madvise(p, size, MADV_SEQUENTIAL);
+            data = static_cast<const char *>(p);
+        }
+        close(fd);
+#else
+        std::FILE *file = std::fopen(path.c_str(), "rb");
+        if (!file) Throw(path);
+        char chunk[1 << 16];
+        std::size_t got;
+        while ((got = std::fread(chunk, 1, sizeof(chunk), file)) > 0) copy.append(chunk, got);
+        bool failed = std::ferror(file);
+        std::fclose(file);
+        if (failed) Throw(path);
+        data = copy.data();
+        size = copy.size();
+#endif
+    }
+
+    ~FileView() {
+#ifdef GATORBST_ROSTER_MMAP
+        if (size) munmap(const_cast<char *>(data), size);
+#endif
+    }
+
+    FileView(const FileView &) = delete;
+    FileView &operator=(const FileView &) = delete;
+
+    std::string_view Text() const { return {data, size}; }
+
+private:
+    [[noreturn]] static void Throw(const std::string &path) {
+        throw std::runtime_error("cannot read roster file " + path + ": " + std::strerror(errno));
+    }
+
+    const char *data = nullptr;
+    std::size_t size = 0;
+#ifndef GATORBST_ROSTER_MMAP
+    std::string copy;
+#endif
+};
+
+// Splits one line into a UFID and a name written into `name`; false if the line is malformed.
+inline bool ParseLine(std::string_view line, int &ufid, std::string &name) {
+    std::size_t delim = line.find_first_of(",\t");
+    if (delim == std::string_view::npos || delim == 0) return false;
+    const char *first = line.data();
+    auto [end, ec] = std::from_chars(first, first + delim, ufid);
+    if (ec != std::errc() || end != first + delim) return false;
+
+    std::string_view field = line.substr(delim + 1);
+    if (field.empty() || field.front() != '"') {
+        name.assign(field);
+        return true;
+    }
+    name.clear();
+    for (std::size_t i = 1; i < field.size(); i++) {
+        if (field[i] != '"') {
+            name.push_back(field[i]);
+        } else if (i + 1 < field.size() && field[i + 1] == '"') {
+            name.push_back('"');
+            i++;
+        } else {
+            return i + 1 == field.size(); // closing quote must end the line
+        }
+    }
+    return false; // no closing quote
+}
+
+} // namespace roster_detail
+
+// Imports every record in the file into tree, in file order, and reports each malformed line and
+// duplicate UFID to onIssue (if set) without stopping. The first skipLines lines (e.g. a column
+// header) are ignored. Throws std::runtime_error only if the file cannot be read.
+inline RosterImportStats ImportRoster(GatorBST &tree, const std::string &path,
+                                      std::size_t skipLines = 0,
+                                      const RosterIssueHandler &onIssue = nullptr) {
+    constexpr std::size_t kBatch = 4096;
+    struct Pending {
+        int ufid;
+        std::string name;
+        std::size_t line;
+        std::string_view text;
+    };
+
+    roster_detail::FileView file(path);
+    std::string_view text = file.Text();
+    RosterImportStats stats;
+    // Slots are reused, so names keep their buffers from one batch to the next.
+    std::vector<Pending> batch(kBatch);
+    std::size_t pending = 0;
+
+    auto flush = [&] {
+        for (std::size_t i = 0; i < pending; i++) {
+            Pending &p = batch[i];
+            if (tree.Insert(p.ufid, p.name)) {
+                stats.inserted++;
+            } else {
+                stats.duplicates++;
+                if (onIssue) onIssue(RosterIssue::Duplicate, p.line, p.text);
+            }
+        }
+        pending = 0;
+    };
+
+    std::size_t lineNo = 0;
+    const char *pos = text.data();
+    const char *end = pos + text.size();
+    while (pos < end) {
+        const char *newline = static_cast<const char *>(std::memchr(pos, '\n', end - pos));
+        const char *stop = newline ? newline : end;
+        std::string_view line(pos, std::size_t(stop - pos));
+        pos = newline ? newline + 1 : end;
+        lineNo++;
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        if (lineNo <= skipLines || line.empty()) continue;
+
+        stats.lines++;
+        Pending &slot = batch[pending];
+        if (!roster_detail::ParseLine(line, slot.ufid, slot.name)) {
+            stats.malformed++;
+            if (onIssue) onIssue(RosterIssue::Malformed, lineNo, line);
+            continue;
+        }
+        slot.line = lineNo;
+        slot.text = line;
+        if (++pending == kBatch) flush();
+    }
+    flush();
+    return stats;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "GatorBST.h"
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Tree-shape diagnostics for GatorBST, built on the public API only. TraversePreorder() fixes the
+// exact shape of a BST with unique keys, so one stack pass over it recovers every node's children
+// and depth, and a reverse sweep gives subtree heights. Both are linear in the node count.
+
+struct TreeShape {
+    std::size_t nodes = 0;
+    int height = 0;                       // 1-based, like Height()
+    std::vector<std::size_t> depthCounts; // depthCounts[d]: nodes at depth d, root at depth 0
+    double averagePathLength = 0;         // mean nodes visited by a successful SearchID
+    int worstImbalance = 0;               // largest |height(left) - height(right)| of any subtree
+    int worstImbalanceUfid = 0;           // root of that subtree (the first in preorder on ties)
+    std::size_t nodeBytes = 0;            // nodes * sizeof(Node), including each inline string
+    std::size_t nameBytes = 0;            // heap bytes of names too long for the inline buffer
+};
+
+// Computes the shape of tree in linear time. Node's name member is not part of the documented
+// interface, so with names set, name sizes are read through SearchID, one lookup per node: that
+// adds nodes * averagePathLength steps. Leave names off for the linear pass alone.
+inline TreeShape ShapeReport(GatorBST &tree, bool names = true) {
+    std::vector<Node *> pre = tree.TraversePreorder();
+    std::size_t n = pre.size();
+    TreeShape shape;
+    shape.nodes = n;
+    shape.nodeBytes = n * sizeof(Node);
+    if (n == 0) return shape;
+
+    // Children and depths: a node's parent is the last key popped below it, else the stack top.
+    std::vector<int> left(n, -1), right(n, -1), depth(n, 0);
+    std::vector<int> stack;
+    std::size_t depthSum = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        int parent = -1;
+        while (!stack.empty() && pre[stack.back()]->ufid < pre[i]->ufid) {
+            parent = stack.back();
+            stack.pop_back();
+        }
+        if (parent >= 0) {
+            right[parent] = int(i);
+        } else if (!stack.empty()) {
+            parent = stack.back();
+            left[parent] = int(i);
+        }
+        depth[i] = parent >= 0 ? depth[parent] + 1 : 0;
+        if (std::size_t(depth[i]) >= shape.depthCounts.size()) shape.depthCounts.resize(depth[i] + 1);
+        shape.depthCounts[depth[i]]++;
+        depthSum += depth[i];
+        stack.push_back(int(i));
+    }
+    shape.height = int(shape.depthCounts.size());
+    shape.averagePathLength = double(depthSum) / double(n) + 1.0;
+
+    // Children come after their parent in preorder, so a reverse sweep sees them first.
+    std::vector<int> height(n, 0);
+    for (std::size_t i = n; i-- > 0;) {
+        int l = left[i] >= 0 ? height[left[i]] : 0;
+        int r = right[i] >= 0 ? height[right[i]] : 0;
+        height[i] = 1 + std::max(l, r);
+        int imbalance = l > r ? l - r : r - l;
+        if (imbalance >= shape.worstImbalance) {
+            shape.worstImbalance = imbalance;
+            shape.worstImbalanceUfid = pre[i]->ufid;
+        }
+    }
+
+    if (names) {
+        const std::size_t inlineChars = std::string().capacity();
+        for (Node *node : pre) {
+            std::size_t length = tree.SearchID(node->ufid).value_or("").size();
+            if (length > inlineChars) shape.nameBytes += length + 1;
+        }
+    }
+    return shape;
+}
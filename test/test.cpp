@@ -1,8 +1,19 @@
 #include <catch2/catch_test_macros.hpp>
+// The vendored catch_amalgamated.hpp (readme Method 3) already provides BENCHMARK
+#ifndef CATCH_AMALGAMATED_HPP_INCLUDED
+#include <catch2/benchmark/catch_benchmark.hpp>
+#endif
 #include "GatorBST.h"
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <memory>
+#include <random>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <map>
+#include <climits>
 
 using namespace std;
 
@@ -13,6 +24,183 @@ vector<int> get_ids(const vector<Node*>& nodes) {
     return ids;
 }
 
+// Distinct 8-digit UFIDs in a reproducible shuffled order, for tests on large trees
+vector<int> shuffled_ids(size_t n, unsigned seed) {
+    vector<int> ids(n);
+    for (size_t i = 0; i < n; i++) ids[i] = 10000000 + (int)i * 7;
+    shuffle(ids.begin(), ids.end(), mt19937(seed));
+    return ids;
+}
+
+// Shape implied by a preorder sequence of unique keys, rebuilt without looking at the tree itself
+struct PreorderShape {
+    bool valid = true;     // false if the sequence cannot be the preorder of a BST
+    int height = 0;        // 1-based, 0 for an empty tree
+    vector<int> postorder;
+};
+
+PreorderShape shape_from_preorder(const vector<int>& pre) {
+    PreorderShape shape;
+    size_t n = pre.size();
+    vector<int> left(n, -1), right(n, -1), depth(n, 0);
+    vector<int> stack;
+    int lower = INT_MIN; // every later key must exceed the last node we turned right at
+    for (size_t i = 0; i < n; i++) {
+        if ((i > 0 && pre[i] <= lower) || (!stack.empty() && pre[i] == pre[stack.back()])) {
+            shape.valid = false;
+            return shape;
+        }
+        int parent = -1;
+        while (!stack.empty() && pre[stack.back()] < pre[i]) {
+            parent = stack.back();
+            stack.pop_back();
+        }
+        if (parent >= 0) {
+            right[parent] = (int)i;
+            lower = pre[parent];
+        } else if (!stack.empty()) {
+            parent = stack.back();
+            left[parent] = (int)i;
+        }
+        depth[i] = parent >= 0 ? depth[parent] + 1 : 1;
+        shape.height = max(shape.height, depth[i]);
+        stack.push_back((int)i);
+    }
+    // Iterative postorder over the rebuilt links (trees can be deep)
+    vector<pair<int, bool>> todo;
+    if (n) todo.push_back({0, false});
+    while (!todo.empty()) {
+        auto [node, expanded] = todo.back();
+        todo.pop_back();
+        if (expanded) {
+            shape.postorder.push_back(pre[node]);
+            continue;
+        }
+        todo.push_back({node, true});
+        if (right[node] >= 0) todo.push_back({right[node], false});
+        if (left[node] >= 0) todo.push_back({left[node], false});
+    }
+    return shape;
+}
+
+// Full-tree comparison against the oracle: contents, all three traversals, Height and SearchName
+void check_against_oracle(GatorBST& tree, const map<int, string>& oracle, const vector<string>& names) {
+    vector<int> keys;
+    for (auto& [id, name] : oracle) keys.push_back(id);
+    REQUIRE(get_ids(tree.TraverseInorder()) == keys);
+
+    vector<int> pre = get_ids(tree.TraversePreorder());
+    REQUIRE(pre.size() == keys.size());
+    PreorderShape shape = shape_from_preorder(pre);
+    REQUIRE(shape.valid);
+    REQUIRE(get_ids(tree.TraversePostorder()) == shape.postorder);
+    REQUIRE(tree.Height() == shape.height);
+
+    for (const string& name : names) {
+        vector<int> expected;
+        for (auto& [id, n] : oracle) if (n == name) expected.push_back(id);
+        REQUIRE(tree.SearchName(name) == expected);
+    }
+}
+
+// Seeded random Insert/Remove/SearchID/SearchName mix checked op-by-op against a std::map; every few ops an
+// ascending run of inserts grows a deep branch, and every check_every ops the whole tree is compared.
+// name_pct of every 100 ops are SearchName, taken from the SearchID share; each one walks the whole
+// tree, so runs on very large trees keep it low.
+void run_stress(unsigned seed, size_t ops, int key_space, size_t check_every, unsigned name_pct) {
+    CAPTURE(seed);
+    mt19937 rng(seed);
+    vector<string> names;
+    for (int i = 0; i < 8; i++) names.push_back("Student" + to_string(i));
+
+    GatorBST tree;
+    map<int, string> oracle;
+    for (size_t op = 1; op <= ops; op++) {
+        int id = (int)(rng() % key_space);
+        unsigned roll = rng() % 100;
+        if (roll < 40) {
+            const string& name = names[rng() % names.size()];
+            bool fresh = !oracle.count(id);
+            REQUIRE(tree.Insert(id, name) == fresh);
+            if (fresh) oracle[id] = name;
+        } else if (roll < 70) {
+            REQUIRE(tree.Remove(id) == (oracle.erase(id) == 1));
+        } else if (roll < 99 - name_pct) {
+            auto it = oracle.find(id);
+            auto found = tree.SearchID(id);
+            REQUIRE(found.has_value() == (it != oracle.end()));
+            if (found) REQUIRE(*found == it->second);
+        } else if (roll < 99) {
+            // One extra name that is never inserted, so the empty result is checked too
+            size_t pick = rng() % (names.size() + 1);
+            string name = pick < names.size() ? names[pick] : "Nobody";
+            vector<int> expected;
+            for (auto& [key, n] : oracle) if (n == name) expected.push_back(key);
+            REQUIRE(tree.SearchName(name) == expected);
+        } else {
+            int run = (int)(rng() % 64);
+            for (int k = id; k < id + run && k < key_space; k++) {
+                bool fresh = !oracle.count(k);
+                REQUIRE(tree.Insert(k, names[0]) == fresh);
+                if (fresh) oracle[k] = names[0];
+            }
+        }
+        if (op % check_every == 0) check_against_oracle(tree, oracle, names);
+    }
+    check_against_oracle(tree, oracle, names);
+
+    // Drain in random order so every removal case is hit on the way down to an empty tree
+    vector<int> remaining;
+    for (auto& [id, name] : oracle) remaining.push_back(id);
+    shuffle(remaining.begin(), remaining.end(), rng);
+    for (size_t i = 0; i < remaining.size(); i++) {
+        REQUIRE(tree.Remove(remaining[i]));
+        oracle.erase(remaining[i]);
+        if (i % check_every == 0) check_against_oracle(tree, oracle, names);
+    }
+    REQUIRE(tree.Height() == 0);
+    REQUIRE(tree.TraverseInorder().empty());
+}
+
+// Allocation tracking: operator new/delete are replaced for the whole test binary, but only count
+// while an AllocCounter is alive on the calling thread. Everything stays in this file so it still
+// works when test.cpp is built on its own.
+struct AllocStats {
+    size_t allocations = 0;
+    size_t bytes = 0;
+};
+
+static thread_local AllocStats *alloc_stats = nullptr;
+
+void *operator new(size_t size) {
+    if (alloc_stats) {
+        alloc_stats->allocations++;
+        alloc_stats->bytes += size;
+    }
+    if (void *p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+
+// Out of line on purpose: once inlined, GCC's -Wmismatched-new-delete flags free() on memory that
+// it saw come from operator new, which breaks optimized -Werror builds
+[[gnu::noinline]] void operator delete(void *p) noexcept { free(p); }
+[[gnu::noinline]] void operator delete(void *p, size_t) noexcept { free(p); }
+
+struct AllocCounter {
+    AllocStats stats;
+    AllocStats *prev;
+    AllocCounter() : prev(alloc_stats) { alloc_stats = &stats; }
+    ~AllocCounter() { alloc_stats = prev; }
+};
+
+// Runs f with allocation counting on; keep REQUIREs outside f so Catch's own allocations don't count
+template <typename F>
+AllocStats count_allocs(F &&f) {
+    AllocCounter counter;
+    f();
+    return counter.stats;
+}
+
 TEST_CASE("BST Ultimate Verification", "[bst]") {
     GatorBST tree;
 
@@ -149,3 +337,123 @@ TEST_CASE("BST Ultimate Verification", "[bst]") {
         REQUIRE(t5.SearchID(30).has_value());
     }
 }
+
+TEST_CASE("BST Randomized Stress vs std::map", "[bst][stress]") {
+    // Fast mode: small key space so trees churn heavily, a few seeds, cheap enough for every build
+    for (unsigned seed : {1u, 2u, 3u}) run_stress(seed, 20000, 2000, 500, 5);
+}
+
+// Hidden by [.]; run with: ./DummyTests "[stress-full]"
+TEST_CASE("BST Randomized Stress vs std::map (Full)", "[.][stress-full]") {
+    // Large deep trees: a SearchName there costs milliseconds, so it is only checked every check_every ops
+    for (unsigned seed : {11u, 12u}) run_stress(seed, 2000000, 200000, 100000, 0);
+    // Heavy churn on small trees, with SearchName checked op-by-op
+    for (unsigned seed : {13u, 14u}) run_stress(seed, 2000000, 2000, 20000, 5);
+}
+
+// Hidden by [!benchmark]; run with: ./DummyTests "[!benchmark]"
+TEST_CASE("BST Benchmarks on Large Trees", "[!benchmark]") {
+    for (size_t n : {10000, 100000}) {
+        vector<int> ids = shuffled_ids(n, 4);
+        string suffix = " (" + to_string(n) + " random)";
+
+        GatorBST tree;
+        for (int id : ids) tree.Insert(id, "Name" + to_string(id % 100));
+
+        BENCHMARK_ADVANCED("Insert" + suffix)(Catch::Benchmark::Chronometer meter) {
+            vector<unique_ptr<GatorBST>> trees(meter.runs());
+            for (auto &t : trees) t = make_unique<GatorBST>();
+            meter.measure([&](int i) {
+                for (int id : ids) trees[i]->Insert(id, "Name");
+            });
+        };
+
+        BENCHMARK("SearchID" + suffix) {
+            size_t found = 0;
+            for (int id : ids) found += tree.SearchID(id).has_value();
+            return found;
+        };
+
+        BENCHMARK("SearchName" + suffix) {
+            return tree.SearchName("Name42");
+        };
+
+        BENCHMARK("Height" + suffix) {
+            return tree.Height();
+        };
+
+        BENCHMARK("TraversePreorder" + suffix) {
+            return tree.TraversePreorder();
+        };
+
+        BENCHMARK("TraverseInorder" + suffix) {
+            return tree.TraverseInorder();
+        };
+
+        BENCHMARK("TraversePostorder" + suffix) {
+            return tree.TraversePostorder();
+        };
+
+        BENCHMARK_ADVANCED("Remove" + suffix)(Catch::Benchmark::Chronometer meter) {
+            vector<unique_ptr<GatorBST>> trees(meter.runs());
+            for (auto &t : trees) {
+                t = make_unique<GatorBST>();
+                for (int id : ids) t->Insert(id, "Name");
+            }
+            meter.measure([&](int i) {
+                for (int id : ids) trees[i]->Remove(id);
+            });
+        };
+    }
+}
+
+TEST_CASE("BST Hot Paths Do Not Allocate", "[bst][alloc]") {
+    const size_t n = 10000;
+    vector<int> ids = shuffled_ids(n, 11);
+    GatorBST tree;
+    for (int id : ids) tree.Insert(id, "Name");
+
+    AllocStats search = count_allocs([&] {
+        for (int id : ids) tree.SearchID(id);
+    });
+    REQUIRE(search.allocations == 0);
+
+    AllocStats misses = count_allocs([&] {
+        for (int id : ids) tree.SearchID(id + 1);
+    });
+    REQUIRE(misses.allocations == 0);
+
+    AllocStats height = count_allocs([&] { tree.Height(); });
+    REQUIRE(height.allocations == 0);
+
+    AllocStats removes = count_allocs([&] {
+        for (int id : ids) tree.Remove(id);
+    });
+    REQUIRE(removes.allocations == 0);
+}
+
+// Hidden by [.]; run with: ./DummyTests "[alloc-profile]"
+TEST_CASE("BST Allocation Profile", "[.][alloc-profile]") {
+    const size_t n = 10000;
+    vector<int> ids = shuffled_ids(n, 11);
+    GatorBST tree;
+    // Short names fit in std::string's inline buffer, so only the tree's own allocations show up
+    AllocStats inserts = count_allocs([&] {
+        for (int id : ids) tree.Insert(id, "Name");
+    });
+    AllocStats byName = count_allocs([&] { tree.SearchName("Name"); });
+    AllocStats pre = count_allocs([&] { tree.TraversePreorder(); });
+    AllocStats in = count_allocs([&] { tree.TraverseInorder(); });
+    AllocStats post = count_allocs([&] { tree.TraversePostorder(); });
+
+    auto report = [](const string &op, const AllocStats &stats, size_t ops) {
+        cout << op << ": " << (double)stats.allocations / ops << " allocations, "
+             << (double)stats.bytes / ops << " bytes per call\n";
+    };
+    report("Insert", inserts, n);
+    report("SearchName", byName, 1);
+    report("TraversePreorder", pre, 1);
+    report("TraverseInorder", in, 1);
+    report("TraversePostorder", post, 1);
+    SUCCEED();
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "GatorBST.h"
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Binary operation traces for GatorBST. A trace file is a TraceHeader followed by fixed-size
+// TraceRecords in host byte order. Names are not stored; a record keeps only the name's length
+// and a hash, which is enough for a replay to rebuild names with the same lengths and the same
+// SearchName match sets.
+
+enum class TraceOp : uint8_t {
+    Insert,
+    Remove,
+    SearchID,
+    SearchName,
+    Height,
+    TraversePreorder,
+    TraverseInorder,
+    TraversePostorder,
+    Count
+};
+
+inline const char *TraceOpName(TraceOp op) {
+    static const char *const names[] = {"Insert",           "Remove",          "SearchID",
+                                        "SearchName",       "Height",          "TraversePreorder",
+                                        "TraverseInorder",  "TraversePostorder"};
+    return op < TraceOp::Count ? names[uint8_t(op)] : "?";
+}
+
+struct TraceHeader {
+    char magic[8] = {'G', 'B', 'S', 'T', 'T', 'R', 'C', '1'};
+    uint32_t recordSize = 24;
+    uint32_t reserved = 0;
+};
+
+struct TraceRecord {
+    uint64_t timestampNs;  // since the recorder was created
+    int32_t ufid;          // Insert/Remove/SearchID only
+    uint32_t nameHash;     // Insert/SearchName only
+    uint16_t nameLength;   // Insert/SearchName only, saturated at 65535
+    TraceOp op;
+    uint8_t reserved[5];
+};
+
+static_assert(sizeof(TraceRecord) == 24, "trace records are written as raw 24-byte blocks");
+
+// FNV-1a; only needs to keep distinct names in one trace apart.
+inline uint32_t TraceNameHash(std::string_view name) {
+    uint32_t h = 2166136261u;
+    for (unsigned char c : name) h = (h ^ c) * 16777619u;
+    return h;
+}
+
+// Deterministic stand-in for a recorded name: equal (hash, length) pairs give equal strings.
+inline std::string TraceSyntheticName(uint32_t hash, uint16_t length) {
+    std::string name(length, 'a');
+    uint32_t x = hash;
+    for (char &c : name) {
+        x = x * 1664525u + 1013904223u;
+        c = char('a' + (x >> 24) % 26);
+    }
+    return name;
+}
+
+// Drop-in wrapper that forwards every call to a GatorBST and appends one record per call to a
+// trace file. Opt in by using RecordedGatorBST in place of GatorBST.
+// A failed write stops recording; ok() reports it and Close() throws, so a short trace is never
+// mistaken for a complete one.
+class RecordedGatorBST {
+public:
+    explicit RecordedGatorBST(const std::string &tracePath)
+        : path(tracePath), file(std::fopen(tracePath.c_str(), "wb")),
+          start(std::chrono::steady_clock::now()) {
+        if (!file)
+            throw std::runtime_error("cannot open trace file " + path + ": " + std::strerror(errno));
+        TraceHeader header;
+        if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+            Fail();
+            std::fclose(file);
+            throw std::runtime_error(error);
+        }
+    }
+
+    // Destructors cannot report errors; call Close() to find out whether the trace is complete.
+    ~RecordedGatorBST() {
+        if (file) std::fclose(file);
+    }
+
+    // True while every record so far has been handed to the file successfully.
+    bool ok() const { return error.empty(); }
+
+    // Flushes and closes the trace; throws std::runtime_error if any write or the close failed.
+    void Close() {
+        if (file) {
+            if (std::fclose(file) != 0) Fail();
+            file = nullptr;
+        }
+        if (!ok()) throw std::runtime_error(error);
+    }
+
+    RecordedGatorBST(const RecordedGatorBST &) = delete;
+    RecordedGatorBST &operator=(const RecordedGatorBST &) = delete;
+
+    int Height() {
+        Log(TraceOp::Height, 0, {});
+        return tree.Height();
+    }
+
+    bool Insert(const int ufid, const std::string &name) {
+        Log(TraceOp::Insert, ufid, name);
+        return tree.Insert(ufid, name);
+    }
+
+    std::optional<std::string_view> SearchID(const int ufid) {
+        Log(TraceOp::SearchID, ufid, {});
+        return tree.SearchID(ufid);
+    }
+
+    std::vector<int> SearchName(const std::string &name) {
+        Log(TraceOp::SearchName, 0, name);
+        return tree.SearchName(name);
+    }
+
+    bool Remove(int ufid) {
+        Log(TraceOp::Remove, ufid, {});
+        return tree.Remove(ufid);
+    }
+
+    std::vector<Node *> TraversePreorder() {
+        Log(TraceOp::TraversePreorder, 0, {});
+        return tree.TraversePreorder();
+    }
+
+    std::vector<Node *> TraverseInorder() {
+        Log(TraceOp::TraverseInorder, 0, {});
+        return tree.TraverseInorder();
+    }
+
+    std::vector<Node *> TraversePostorder() {
+        Log(TraceOp::TraversePostorder, 0, {});
+        return tree.TraversePostorder();
+    }
+
+private:
+    void Log(TraceOp op, int ufid, std::string_view name) {
+        TraceRecord r{};
+        r.timestampNs = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now() - start)
+                                     .count());
+        r.ufid = ufid;
+        r.nameHash = name.empty() ? 0 : TraceNameHash(name);
+        r.nameLength = uint16_t(name.size() > 65535 ? 65535 : name.size());
+        r.op = op;
+        if (file && ok() && std::fwrite(&r, sizeof(r), 1, file) != 1) Fail();
+    }
+
+    // Keeps the first failure only; later errors are usually consequences of it.
+    void Fail() {
+        if (ok()) error = "write to trace file " + path + " failed: " + std::strerror(errno);
+    }
+
+    GatorBST tree;
+    std::string path;
+    std::string error;
+    std::FILE *file;
+    std::chrono::steady_clock::time_point start;
+};
+
+// Reads a whole trace into memory; throws std::runtime_error on a malformed file.
+inline std::vector<TraceRecord> ReadTrace(const std::string &tracePath) {
+    std::FILE *file = std::fopen(tracePath.c_str(), "rb");
+    if (!file) throw std::runtime_error("cannot open trace file " + tracePath);
+    TraceHeader expected, header;
+    bool ok = std::fread(&header, sizeof(header), 1, file) == 1 &&
+              std::string_view(header.magic, 8) == std::string_view(expected.magic, 8) &&
+              header.recordSize == sizeof(TraceRecord) && header.reserved == 0;
+    std::vector<TraceRecord> records;
+    TraceRecord r;
+    while (ok) {
+        std::size_t got = std::fread(&r, 1, sizeof(r), file);
+        if (got == 0) break;
+        // A partial record means the file was truncated mid-write
+        if (got != sizeof(r) || r.op >= TraceOp::Count) ok = false;
+        else records.push_back(r);
+    }
+    if (std::ferror(file) || (ok && !std::feof(file))) ok = false;
+    std::fclose(file);
+    if (!ok) throw std::runtime_error("malformed trace file " + tracePath);
+    return records;
+}
@@ -0,0 +1,173 @@
+#include "GatorBST.h"
+#include "latency_histogram.h"
+#include "zipf_generator.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// YCSB-style macro workloads for GatorBST. Each standard mix runs for a fixed time on a freshly
+// loaded roster at 1, 2, 4, ... threads plus max_threads, and prints one CSV row per (workload, threads):
+//   workload,threads,records,ops,seconds,ops_per_sec,p50_ns,p99_ns,p999_ns,max_ns
+// Usage: WorkloadGatorBST [records] [seconds_per_run] [max_threads]
+//
+// GatorBST is not thread-safe, so threads share it behind one mutex, as a service would.
+// Latencies are per operation and include time spent waiting for the lock.
+
+namespace {
+
+struct Mix {
+    const char *name;
+    int read;    // SearchID
+    int update;  // drop + re-add with a new name (Remove then Insert under one lock hold)
+    int insert;  // add a brand-new record
+    int scan;    // full roster scan (TraverseInorder)
+    int rmw;     // SearchID, then update based on the result, under one lock hold
+    bool latest; // reads favour the most recently inserted records instead of Zipf-hot ones
+};
+
+// Percentages of each operation; every row sums to 100.
+const Mix kMixes[] = {
+    {"read-heavy", 95, 5, 0, 0, 0, false},
+    {"update-heavy", 50, 50, 0, 0, 0, false},
+    {"scan-heavy", 0, 0, 5, 95, 0, false},
+    {"insert-latest", 95, 0, 5, 0, 0, true},
+    {"read-modify-write", 50, 0, 0, 0, 50, false},
+};
+
+// Record number -> UFID. Multiplying by an odd constant not divisible by 5 permutes [0, 8e7), so
+// consecutive record numbers land far apart and loading in record order still gives a bushy tree.
+int Ufid(uint64_t record) { return 10000000 + int(record * 2654435761ULL % 80000000ULL); }
+
+const string &NameFor(uint64_t x) {
+    static const vector<string> names = [] {
+        vector<string> v;
+        for (int i = 0; i < 1000; i++) v.push_back("Student" + to_string(i));
+        return v;
+    }();
+    return names[x % names.size()];
+}
+
+// Keeps the optimizer from discarding results; shared by all workers.
+atomic<size_t> sink{0};
+
+struct Shared {
+    GatorBST tree;
+    mutex lock;
+    // Records [0, inserted) are all in the tree. New record numbers are assigned under the lock
+    // and published only after their Insert returns, so insert-latest never reads ahead of them.
+    atomic<uint64_t> inserted{0};
+    atomic<bool> start{false};
+    atomic<bool> stop{false};
+};
+
+void Worker(Shared &shared, const Mix &mix, const ZipfGenerator &zipf, unsigned seed,
+            LatencyHistogram &latency, uint64_t &ops) {
+    mt19937_64 rng(seed);
+    size_t acc = 0;
+    uint64_t count = 0; // stored once at exit: neighbouring threads' counters share a cache line
+    while (!shared.start.load(memory_order_acquire)) this_thread::yield();
+
+    while (!shared.stop.load(memory_order_relaxed)) {
+        int roll = int(rng() % 100);
+        // Hot record: Zipf rank over the loaded roster, or back from the newest for insert-latest.
+        uint64_t rank = zipf(rng);
+        uint64_t record = rank;
+        if (mix.latest) {
+            uint64_t newest = shared.inserted.load(memory_order_acquire);
+            record = newest - 1 - min(rank, newest - 1);
+        }
+        int ufid = Ufid(record);
+
+        auto begin = chrono::steady_clock::now();
+        if ((roll -= mix.read) < 0) {
+            lock_guard<mutex> guard(shared.lock);
+            acc += shared.tree.SearchID(ufid).has_value();
+        } else if ((roll -= mix.update) < 0) {
+            lock_guard<mutex> guard(shared.lock);
+            if (shared.tree.Remove(ufid)) acc += shared.tree.Insert(ufid, NameFor(rng()));
+        } else if ((roll -= mix.insert) < 0) {
+            lock_guard<mutex> guard(shared.lock);
+            uint64_t fresh = shared.inserted.load(memory_order_relaxed);
+            acc += shared.tree.Insert(Ufid(fresh), NameFor(fresh));
+            shared.inserted.store(fresh + 1, memory_order_release);
+        } else if ((roll -= mix.scan) < 0) {
+            lock_guard<mutex> guard(shared.lock);
+            acc += shared.tree.TraverseInorder().size();
+        } else {
+            lock_guard<mutex> guard(shared.lock);
+            auto name = shared.tree.SearchID(ufid);
+            if (name && shared.tree.Remove(ufid))
+                acc += shared.tree.Insert(ufid, NameFor(name->size() + rng()));
+        }
+        auto elapsed = chrono::steady_clock::now() - begin;
+        latency.Record(uint64_t(chrono::duration_cast<chrono::nanoseconds>(elapsed).count()));
+        count++;
+    }
+    ops = count;
+    sink.fetch_add(acc, memory_order_relaxed);
+}
+
+void Run(const Mix &mix, uint64_t records, double seconds, unsigned threads) {
+    Shared shared;
+    for (uint64_t r = 0; r < records; r++) shared.tree.Insert(Ufid(r), NameFor(r));
+    shared.inserted = records;
+    ZipfGenerator zipf(size_t(records), 0.99);
+
+    vector<LatencyHistogram> latency(threads);
+    vector<uint64_t> ops(threads, 0);
+    vector<thread> pool;
+    for (unsigned t = 0; t < threads; t++)
+        pool.emplace_back(Worker, ref(shared), cref(mix), cref(zipf), 1000 + t, ref(latency[t]),
+                          ref(ops[t]));
+
+    auto begin = chrono::steady_clock::now();
+    shared.start.store(true, memory_order_release);
+    this_thread::sleep_for(chrono::duration<double>(seconds));
+    shared.stop.store(true, memory_order_relaxed);
+    for (thread &t : pool) t.join();
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+    LatencyHistogram all;
+    uint64_t total = 0;
+    for (unsigned t = 0; t < threads; t++) {
+        all.Merge(latency[t]);
+        total += ops[t];
+    }
+    printf("%s,%u,%llu,%llu,%.3f,%.0f,%llu,%llu,%llu,%llu\n", mix.name, threads,
+           (unsigned long long)records, (unsigned long long)total, elapsed, double(total) / elapsed,
+           (unsigned long long)all.Percentile(0.50), (unsigned long long)all.Percentile(0.99),
+           (unsigned long long)all.Percentile(0.999), (unsigned long long)all.Max());
+    fflush(stdout);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    uint64_t records = argc > 1 ? strtoull(argv[1], nullptr, 10) : 100000;
+    double seconds = argc > 2 ? strtod(argv[2], nullptr) : 2.0;
+    unsigned maxThreads = argc > 3 ? unsigned(strtoul(argv[3], nullptr, 10))
+                                   : max(1u, thread::hardware_concurrency());
+    if (records == 0 || seconds <= 0 || maxThreads == 0) {
+        fprintf(stderr, "usage: %s [records > 0] [seconds_per_run > 0] [max_threads > 0]\n",
+                argv[0]);
+        return 2;
+    }
+
+    printf("workload,threads,records,ops,seconds,ops_per_sec,p50_ns,p99_ns,p999_ns,max_ns\n");
+    for (const Mix &mix : kMixes) {
+        unsigned threads = 1;
+        for (; threads < maxThreads; threads *= 2) Run(mix, records, seconds, threads);
+        Run(mix, records, seconds, maxThreads);
+    }
+    return 0;
+}
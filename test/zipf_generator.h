@@ -0,0 +1,30 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+// Draws ranks in [0, n) with P(k) proportional to 1 / (k + 1)^s. Sampling only reads the table, so
+// one generator can be shared by threads that each bring their own engine.
+class ZipfGenerator {
+public:
+    ZipfGenerator(std::size_t n, double s) : cdf(n) {
+        double sum = 0;
+        for (std::size_t k = 0; k < n; k++) {
+            sum += 1.0 / std::pow(double(k + 1), s);
+            cdf[k] = sum;
+        }
+        for (double &c : cdf) c /= sum;
+    }
+
+    std::size_t operator()(std::mt19937_64 &rng) const {
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        std::size_t k = std::size_t(std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin());
+        return std::min(k, cdf.size() - 1);
+    }
+
+private:
+    std::vector<double> cdf;
+};